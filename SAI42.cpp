@@ -2,7 +2,7 @@
 *                         Author: Abderrahmane Abdelouafi                          *
 *                               File Name: SAI42.cpp                               *
 *                      Creation Date: April 6, 2025 08:24 AM                       *
-*                      Last Updated: April 23, 2025 01:45 PM                       *
+*                      Last Updated: October 18, 2026                              *
 *                               Source Language: cpp                               *
 *                                                                                  *
 *                             --- Code Description ---                             *
@@ -23,7 +23,9 @@ SAI::SAI(const String& wifiSSID,
          const String& wifiPassword,
          const String& adminUser,
          const String& adminPassword,
-         const String& serialKey)
+         const String& serialKey,
+         const String& forecastURL,
+         const char* forecastRootCA)
   : server(80),
     ws("/ws"),
     lcd(0x27, 16, 2),
@@ -33,11 +35,14 @@ SAI::SAI(const String& wifiSSID,
     currentLighting("unknown"),
     currentMoisture(-1),
     currentWeatherStatus("Unknown"),
+    currentForecast("Unknown"),
     _wifiSSID(wifiSSID),
     _wifiPassword(wifiPassword),
     _adminUser(adminUser),
     _adminPassword(adminPassword),
     _serialKey(serialKey),
+    _forecastURL(forecastURL),
+    _forecastRootCA(forecastRootCA),
     apiKey(""),
     watering(false),
     displayState(DISPLAY_NORMAL),
@@ -58,6 +63,7 @@ void SAI::begin() {
   lcd.backlight();
   lcd.clear();
   connectToWiFi();
+  forecast.begin(_forecastURL, _forecastRootCA);
   randomSeed(analogRead(0));
   apiKey = generateRandomAPIKey(16);
   if (!LittleFS.begin()) {
@@ -111,11 +117,15 @@ void SAI::updateSensors() {
   currentLighting = getLighting();
   currentMoisture = getMoisture();
   currentWeatherStatus = getWeather();
+  WeatherForecast::Snapshot outlook = forecast.snapshot();
+  currentForecast = forecast.describe(outlook);
   String pumpState = getPumpStatus();
   String plantState = computePlantStatus(currentMoisture);
 
   // decide pump control: automatic OR manual
-  bool shouldAutoWater = (currentMoisture < 25) && (currentWeatherStatus == "Clear");
+  // rain forecast: skip watering unless critically dry, then stop at CRITICAL_MOISTURE
+  int autoWaterBelow = (outlook.valid && outlook.rainExpected) ? CRITICAL_MOISTURE : DRY_MOISTURE;
+  bool shouldAutoWater = (currentMoisture < autoWaterBelow) && (currentWeatherStatus == "Clear");
   bool shouldManualWater = manualWateringActive && (millis() < waterEndTime);
   bool pumpOn = shouldAutoWater || shouldManualWater;
   digitalWrite(PUMP_PIN, pumpOn ? LOW : HIGH);  // INVERTED LOGIC
@@ -142,12 +152,13 @@ void SAI::updateSensors() {
     remaining = (waterEndTime - millis()) / 1000;
   }
 
-  DynamicJsonDocument doc(256);
+  DynamicJsonDocument doc(384);
   doc["temperature"] = currentTemperature;
   doc["humidity"] = currentHumidity;
   doc["lighting"] = currentLighting;
   doc["moisture"] = currentMoisture;
   doc["weather"] = currentWeatherStatus;
+  doc["forecast"] = currentForecast;
   doc["pumpStatus"] = pumpState;
   doc["plantStatus"] = plantState;
   doc["countdown"] = remaining;
@@ -253,6 +264,9 @@ void SAI::setupRoutes() {
   server.on("/weatherStatus", HTTP_GET, [this](AsyncWebServerRequest* request) {
     handleWeather(request);
   });
+  server.on("/forecast", HTTP_GET, [this](AsyncWebServerRequest* request) {
+    handleForecast(request);
+  });
   server.on("/pumpStatus", HTTP_GET, [this](AsyncWebServerRequest* request) {
     handleIsWatering(request);
   });
@@ -438,6 +452,11 @@ void SAI::handleWeather(AsyncWebServerRequest* request) {
   request->send(200, "text/plain", getWeather());
 }
 
+void SAI::handleForecast(AsyncWebServerRequest* request) {
+  if (!ensureUserAuthenticated(request) || !validateAPIKey(request)) return;
+  request->send(200, "text/plain", forecast.describe(forecast.snapshot()));
+}
+
 void SAI::handleIsWatering(AsyncWebServerRequest* request) {
   if (!ensureUserAuthenticated(request) || !validateAPIKey(request)) return;
   request->send(200, "text/plain", manualWateringActive ? "ON" : "OFF");
@@ -523,7 +542,7 @@ String SAI::getPumpStatus() {
 
 // Compute plant status from moisture%
 String SAI::computePlantStatus(int moisture) {
-  if (moisture < 25) return "Dry";
+  if (moisture < DRY_MOISTURE) return "Dry";
   else if (moisture < 50) return "Thirsty";
   else if (moisture <= 75) return "Healthy";
   else return "Overwatered";
@@ -3,13 +3,13 @@
 *                         Author: Abderrahmane Abdelouafi                          *
 *                               File Name: SAI42.hpp                               *
 *                      Creation Date: April 6, 2025 08:24 AM                       *
-*                      Last Updated: April 23, 2025                                *
+*                      Last Updated: October 18, 2026                              *
 *                               Source Language: cpp                               *
 *                                                                                  *
 *                             --- Code Description ---                             *
 *  Defines the SAI class and all needed libraries and variables for managing the   *
 *                smart automated irrigation system, now including soil moisture    *
-*                    and rainfall (weather) detection.                             *
+*          and rainfall (weather) detection plus an optional rain forecast.        *
 ***********************************************************************************/
 
 #ifndef SAI42_HPP
@@ -26,10 +26,11 @@
 #endif
 
 #include <WiFi.h>
-#include <HTTPClient.h>
 #include <ESPAsyncWebServer.h>
 #include <AsyncTCP.h>
 
+#include "WeatherForecast.hpp"
+
 // Sensor pin definitions
 static const uint8_t DHT_PIN = 4;
 static const uint8_t DHT_TYPE = DHT22;
@@ -38,6 +39,10 @@ static const uint8_t LDR_PIN = 34;
 static const uint8_t RAIN_PIN = 15;
 static const uint8_t PUMP_PIN = 5;
 
+// Auto-watering thresholds (soil moisture %)
+static const int DRY_MOISTURE = 25;       // water below this when no rain is forecast
+static const int CRITICAL_MOISTURE = 10;  // only water below this when rain is forecast
+
 // Global watering state variables
 extern bool manualWateringActive;
 extern unsigned long waterEndTime;
@@ -60,7 +65,9 @@ public:
       const String &wifiPassword,
       const String &adminUser,
       const String &adminPassword,
-      const String &serialKey);
+      const String &serialKey,
+      const String &forecastURL = "",
+      const char *forecastRootCA = nullptr);
 
   const String getApiKey() const;
   void begin();
@@ -72,14 +79,17 @@ private:
   AsyncWebSocket ws;
   LiquidCrystal_I2C lcd;
   DHT dht;
+  WeatherForecast forecast;
 
   int currentHumidity;
   int currentTemperature;
   String currentLighting;
   int currentMoisture;
   String currentWeatherStatus;
+  String currentForecast;
 
-  String _wifiSSID, _wifiPassword, _adminUser, _adminPassword, _serialKey;
+  String _wifiSSID, _wifiPassword, _adminUser, _adminPassword, _serialKey, _forecastURL;
+  const char *_forecastRootCA;
   String apiKey;
   bool watering;
   DisplayState displayState;
@@ -134,6 +144,7 @@ private:
   void handleWater(AsyncWebServerRequest *request);
   void handleMoisture(AsyncWebServerRequest *request);
   void handleWeather(AsyncWebServerRequest *request);
+  void handleForecast(AsyncWebServerRequest *request);
   void handlePermissionDenied(AsyncWebServerRequest *request);
   void handleNotFound(AsyncWebServerRequest *request);
   void handleUnauthorized(AsyncWebServerRequest *request);
@@ -2,7 +2,7 @@
 *                         Author: Abderrahmane Abdelouafi                          *
 *                               File Name: SAI42.ino                               *
 *                      Creation Date: April 6, 2025 08:24 AM                       *
-*                      Last Updated: April 10, 2025 01:49 PM                       *
+*                      Last Updated: October 18, 2026                              *
 *                               Source Language: cpp                               *
 *                                                                                  *
 *                             --- Code Description ---                             *
@@ -11,8 +11,20 @@
 
 #include "SAI42.hpp"
 
-// Create the SAI object with 5 parameters: WiFi SSID, WiFi Password, admin username, admin password, and the device serial key.
-SAI sai42("SAI42", "P.07eOaMoSAI42q9W_", "user", "admin", "E4D2U");
+// Hourly rain forecast provider (Open-Meteo format), "" disables it. The response must include
+// hourly.time and utc_offset_seconds; the device syncs its clock over NTP and starts the forecast
+// window at the entry for the current hour. Example with your coordinates:
+//   "http://api.open-meteo.com/v1/forecast?latitude=LAT&longitude=LON"
+//   "&hourly=precipitation_probability,precipitation&forecast_days=2"
+// For testing, run tools/forecast_stub.py and use "http://<PC_IP>:8000/rain" or "http://<PC_IP>:8000/dry".
+static const char* forecastURL = "";
+
+// Root CA (PEM) for https:// forecast URLs. Without it the TLS certificate is NOT verified, so a
+// spoofed server could report rain and suppress auto-watering.
+static const char* forecastRootCA = nullptr;
+
+// Create the SAI object with WiFi SSID, WiFi Password, admin username, admin password, the device serial key and the optional forecast URL and root CA.
+SAI sai42("SAI42", "P.07eOaMoSAI42q9W_", "user", "admin", "E4D2U", forecastURL, forecastRootCA);
 unsigned long lastSensorUpdate = 0;
 static const int sensorUpdateInterval = 1000;  // 1 second
 
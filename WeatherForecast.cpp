@@ -0,0 +1,216 @@
+/***********************************************************************************
+*                         Author: Abderrahmane Abdelouafi                          *
+*                           File Name: WeatherForecast.cpp                         *
+*                      Creation Date: October 18, 2026                             *
+*                      Last Updated: October 18, 2026                              *
+*                               Source Language: cpp                               *
+*                                                                                  *
+*                             --- Code Description ---                             *
+*  Implements the WeatherForecast class. The forecast task fetches and parses      *
+*    hourly precipitation data off the control loop; callers read a copy of the    *
+*     cached hours under a spinlock and only the hours still ahead are used.       *
+***********************************************************************************/
+
+#include "WeatherForecast.hpp"
+
+// Any time before this means NTP has not synced yet
+static const time_t MIN_VALID_EPOCH = 1700000000;
+
+// Constructor – empty cache, task started by begin()
+WeatherForecast::WeatherForecast()
+  : _url(""),
+    _rootCA(nullptr),
+    task(nullptr),
+    lock(portMUX_INITIALIZER_UNLOCKED),
+    cache{} {}
+
+// begin: Start the background fetcher (no-op when no provider is configured)
+void WeatherForecast::begin(const String& url, const char* rootCA) {
+  _url = url;
+  _rootCA = rootCA;
+  if (_url.isEmpty()) {
+    Serial.println("Weather forecast disabled (no provider URL)");
+    return;
+  }
+  if (_url.startsWith("https://") && !_rootCA) {
+    Serial.println("Forecast: no root CA given, TLS certificate is NOT verified");
+  }
+  // Hourly data is matched against the current hour, so a UTC clock is needed
+  configTime(0, 0, "pool.ntp.org", "time.nist.gov");
+  // Core 0 keeps HTTP/TLS work away from loop(), which runs on core 1
+  xTaskCreatePinnedToCore(taskEntry, "forecast", 8192, this, 1, &task, 0);
+  Serial.println("Weather forecast task started");
+}
+
+// snapshot: Evaluate the cached hours still ahead; requests a refresh once the TTL has elapsed
+WeatherForecast::Snapshot WeatherForecast::snapshot() {
+  Entry entry;
+  portENTER_CRITICAL(&lock);
+  entry = cache;
+  portEXIT_CRITICAL(&lock);
+
+  Snapshot outlook = { false, false, false, -1, 0, 0, 0.0f };
+  if (!entry.hasData) return outlook;
+
+  unsigned long age = millis() - entry.fetchedAt;
+  if (age >= FORECAST_TTL_MS) {
+    outlook.stale = true;
+    if (task) xTaskNotifyGive(task);
+  }
+  if (age >= FORECAST_TTL_MS + FORECAST_STALE_MS) return outlook;
+
+  // Skip the hours that have passed since the fetch
+  time_t now = time(nullptr);
+  int first = now > entry.windowStart ? (now - entry.windowStart) / 3600 : 0;
+  if (first >= entry.hours) return outlook;
+
+  outlook.valid = true;
+  outlook.horizonHours = entry.hours - first;
+  for (int i = first; i < entry.hours; i++) {
+    outlook.maxProbability = max(outlook.maxProbability, (int)entry.probability[i]);
+    outlook.totalRainMm += entry.amount[i];
+    if (!outlook.rainExpected && entry.probability[i] >= RAIN_PROBABILITY_THRESHOLD
+        && entry.amount[i] >= RAIN_AMOUNT_THRESHOLD_MM) {
+      outlook.rainExpected = true;
+      outlook.hoursUntilRain = i - first;
+    }
+  }
+  return outlook;
+}
+
+// describe: Short human readable summary for the dashboard
+String WeatherForecast::describe(const Snapshot& outlook) const {
+  if (!outlook.valid) return "Unknown";
+  String text;
+  if (!outlook.rainExpected) text = "No rain " + String(outlook.horizonHours) + "h";
+  else if (outlook.hoursUntilRain == 0) text = "Rain now (" + String(outlook.maxProbability) + "%)";
+  else text = "Rain in " + String(outlook.hoursUntilRain) + "h (" + String(outlook.maxProbability) + "%)";
+  if (outlook.stale) text += " (stale)";
+  return text;
+}
+
+void WeatherForecast::taskEntry(void* arg) {
+  static_cast<WeatherForecast*>(arg)->run();
+}
+
+// run: Forecast task loop, woken early by snapshot() when the cache expires
+void WeatherForecast::run() {
+  for (;;) {
+    if (WiFi.status() == WL_CONNECTED && time(nullptr) >= MIN_VALID_EPOCH && isDue()) {
+      Entry fresh;
+      if (fetch(fresh)) {
+        portENTER_CRITICAL(&lock);
+        cache = fresh;
+        portEXIT_CRITICAL(&lock);
+        Serial.printf("Forecast updated: %u hours cached\n", fresh.hours);
+      } else {
+        vTaskDelay(pdMS_TO_TICKS(FORECAST_RETRY_MS));
+        continue;
+      }
+    }
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(FORECAST_RETRY_MS));
+  }
+}
+
+bool WeatherForecast::isDue() {
+  portENTER_CRITICAL(&lock);
+  bool due = !cache.hasData || (millis() - cache.fetchedAt >= FORECAST_TTL_MS);
+  portEXIT_CRITICAL(&lock);
+  return due;
+}
+
+// fetch: GET the provider URL (http or https) and parse the body
+bool WeatherForecast::fetch(Entry& out) {
+  std::unique_ptr<WiFiClient> client;
+  if (_url.startsWith("https://")) {
+    WiFiClientSecure* secureClient = new WiFiClientSecure;
+    if (_rootCA) secureClient->setCACert(_rootCA);
+    else secureClient->setInsecure();
+    client.reset(secureClient);
+  } else {
+    client.reset(new WiFiClient);
+  }
+
+  HTTPClient http;
+  http.setConnectTimeout(FORECAST_HTTP_TIMEOUT_MS);
+  http.setTimeout(FORECAST_HTTP_TIMEOUT_MS);
+  if (!http.begin(*client, _url)) {
+    Serial.println("Forecast: invalid provider URL");
+    return false;
+  }
+  int code = http.GET();
+  if (code != HTTP_CODE_OK) {
+    Serial.printf("Forecast: HTTP request failed (%d)\n", code);
+    http.end();
+    return false;
+  }
+  String body = http.getString();
+  http.end();
+  return parse(body, out);
+}
+
+// parse: Read Open-Meteo style hourly arrays and keep the hours from the current one on
+//   { "utc_offset_seconds": 0,
+//     "hourly": { "time": ["2026-10-18T08:00", ..],
+//                 "precipitation_probability": [..], "precipitation": [..] } }
+bool WeatherForecast::parse(const String& body, Entry& out) {
+  StaticJsonDocument<192> filter;
+  filter["utc_offset_seconds"] = true;
+  filter["hourly"]["time"] = true;
+  filter["hourly"]["precipitation_probability"] = true;
+  filter["hourly"]["precipitation"] = true;
+
+  DynamicJsonDocument doc(FORECAST_JSON_CAPACITY);
+  DeserializationError err = deserializeJson(doc, body, DeserializationOption::Filter(filter));
+  if (err == DeserializationError::NoMemory) {
+    Serial.println("Forecast: response too large, limit it with &forecast_days= or &forecast_hours=");
+    return false;
+  }
+  if (err) {
+    Serial.print("Forecast: JSON parse failed: ");
+    Serial.println(err.c_str());
+    return false;
+  }
+  JsonArray times = doc["hourly"]["time"];
+  JsonArray probabilities = doc["hourly"]["precipitation_probability"];
+  JsonArray amounts = doc["hourly"]["precipitation"];
+  if (times.isNull() || probabilities.isNull() || amounts.isNull()) {
+    Serial.println("Forecast: missing hourly time or precipitation data");
+    return false;
+  }
+
+  // Provider times are local to utc_offset_seconds; find the entry of the current hour
+  long offset = doc["utc_offset_seconds"] | 0L;
+  time_t localNow = time(nullptr) + offset;
+  time_t localHour = localNow - localNow % 3600;
+  struct tm hourTm;
+  gmtime_r(&localHour, &hourTm);
+  char current[17];
+  strftime(current, sizeof(current), "%Y-%m-%dT%H:%M", &hourTm);
+
+  size_t count = min(times.size(), min(probabilities.size(), amounts.size()));
+  size_t first = count;
+  for (size_t i = 0; i < count; i++) {
+    const char* stamp = times[i] | "";
+    if (strncmp(stamp, current, 16) == 0) {
+      first = i;
+      break;
+    }
+  }
+  if (first == count) {
+    Serial.printf("Forecast: hourly data does not cover the current hour (%s)\n", current);
+    return false;
+  }
+
+  out = {};
+  out.hasData = true;
+  out.windowStart = localHour - offset;
+  out.fetchedAt = millis();
+  out.hours = min(count - first, (size_t)FORECAST_HORIZON_HOURS);
+  for (size_t i = 0; i < out.hours; i++) {
+    int probability = probabilities[first + i] | 0;
+    out.probability[i] = constrain(probability, 0, 100);
+    out.amount[i] = amounts[first + i] | 0.0f;
+  }
+  return true;
+}
@@ -0,0 +1,80 @@
+// File: WeatherForecast.hpp
+/***********************************************************************************
+*                         Author: Abderrahmane Abdelouafi                          *
+*                           File Name: WeatherForecast.hpp                         *
+*                      Creation Date: October 18, 2026                             *
+*                      Last Updated: October 18, 2026                              *
+*                               Source Language: cpp                               *
+*                                                                                  *
+*                             --- Code Description ---                             *
+*  Defines the WeatherForecast class, a background rain forecast fetcher. A        *
+*    FreeRTOS task polls a configurable HTTP provider and caches the hourly        *
+*       values with a TTL and a stale-while-revalidate window, so the control      *
+*                       loop only ever reads the cached snapshot.                  *
+***********************************************************************************/
+
+#ifndef WEATHER_FORECAST_HPP
+#define WEATHER_FORECAST_HPP
+
+#include <memory>
+#include <time.h>
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+#include <HTTPClient.h>
+
+// Cache policy
+static const unsigned long FORECAST_TTL_MS = 30UL * 60UL * 1000UL;          // refresh after 30 min
+static const unsigned long FORECAST_STALE_MS = 3UL * 60UL * 60UL * 1000UL;  // serve stale for 3 h more
+static const unsigned long FORECAST_RETRY_MS = 60UL * 1000UL;               // retry failed fetches every minute
+static const uint16_t FORECAST_HTTP_TIMEOUT_MS = 5000;
+static const size_t FORECAST_JSON_CAPACITY = 16384;  // 3 x 168 hourly values (Open-Meteo default)
+
+// Rain decision
+static const uint8_t FORECAST_HORIZON_HOURS = 6;
+static const uint8_t RAIN_PROBABILITY_THRESHOLD = 60;  // %
+static const float RAIN_AMOUNT_THRESHOLD_MM = 1.0f;    // per hour
+
+class WeatherForecast {
+public:
+  struct Snapshot {
+    bool valid;           // a usable forecast is cached (fresh or stale)
+    bool stale;           // past the TTL, a refresh has been requested
+    bool rainExpected;    // rain expected within the remaining horizon
+    int hoursUntilRain;   // -1 when no rain is expected
+    int horizonHours;     // forecast hours left from now (shrinks while stale)
+    int maxProbability;   // highest precipitation probability (%) in horizon
+    float totalRainMm;    // summed precipitation (mm) in horizon
+  };
+
+  WeatherForecast();
+
+  void begin(const String &url, const char *rootCA = nullptr);
+  Snapshot snapshot();
+  String describe(const Snapshot &outlook) const;
+
+private:
+  struct Entry {
+    bool hasData;
+    uint8_t hours;                                  // valid values below
+    uint8_t probability[FORECAST_HORIZON_HOURS];    // % per hour, [0] = windowStart
+    float amount[FORECAST_HORIZON_HOURS];           // mm per hour
+    time_t windowStart;                             // UTC start of the first hour
+    unsigned long fetchedAt;                        // millis() of the fetch
+  };
+
+  String _url;
+  const char *_rootCA;
+  TaskHandle_t task;
+  portMUX_TYPE lock;
+  Entry cache;
+
+  static void taskEntry(void *arg);
+  void run();
+  bool isDue();
+  bool fetch(Entry &out);
+  bool parse(const String &body, Entry &out);
+};
+
+#endif  // WEATHER_FORECAST_HPP
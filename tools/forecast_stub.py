@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+"""Local stub forecast provider for testing SAI42 without a real weather API.
+
+Serves the JSON fixtures next to this script in the Open-Meteo hourly format
+parsed by WeatherForecast::parse(). hourly.time is rewritten on every request
+to start at the current UTC hour, matching what the device looks for:
+  GET /rain  -> forecast_rain.json (rain expected within the horizon)
+  GET /dry   -> forecast_dry.json  (no rain expected)
+"""
+
+import argparse
+import json
+import os
+from datetime import datetime, timedelta, timezone
+from http.server import BaseHTTPRequestHandler, HTTPServer
+
+FIXTURES = {
+    "/rain": "forecast_rain.json",
+    "/dry": "forecast_dry.json",
+}
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+class ForecastHandler(BaseHTTPRequestHandler):
+    def do_GET(self):
+        name = FIXTURES.get(self.path.split("?", 1)[0])
+        if name is None:
+            self.send_error(404, "Use /rain or /dry")
+            return
+        with open(os.path.join(HERE, name)) as f:
+            forecast = json.load(f)
+        hourly = forecast["hourly"]
+        start = datetime.now(timezone.utc).replace(minute=0, second=0, microsecond=0)
+        hourly["time"] = [(start + timedelta(hours=i)).strftime("%Y-%m-%dT%H:%M")
+                          for i in range(len(hourly["precipitation"]))]
+        body = json.dumps(forecast).encode()
+        self.send_response(200)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--host", default="0.0.0.0")
+    parser.add_argument("--port", type=int, default=8000)
+    args = parser.parse_args()
+    server = HTTPServer((args.host, args.port), ForecastHandler)
+    print(f"Forecast stub listening on http://{args.host}:{args.port} (/rain, /dry)")
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()